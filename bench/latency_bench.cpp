@@ -0,0 +1,89 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// Measures submit-to-start latency, i.e., the time between a task being
+// submitted to the scheduler and the task beginning execution on a worker, for
+// each executor wait policy. Tasks are submitted one at a time so that each
+// sample reflects the wakeup path rather than queueing delay.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+#include "rio/executor.hpp"
+#include "rio/wait_policy.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+/// Number of warmup submissions discarded before sampling.
+constexpr std::size_t warmup_iterations = 1000;
+
+/// Returns the sample at the specified percentile of a sorted sample set.
+auto percentile(const std::vector<clock_type::duration>& samples, double p)
+    -> std::chrono::nanoseconds {
+  auto index = static_cast<std::size_t>(p * (samples.size() - 1));
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(samples[index]);
+}
+
+/// Samples submit-to-start latency for an executor with the given wait policy.
+template <rio::wait_policy W>
+auto measure(std::size_t iterations) -> std::vector<clock_type::duration> {
+  rio::executor<4, rio::fcfs_scheduler, W> executor;
+  auto& scheduler = executor.get_scheduler();
+  std::vector<clock_type::duration> samples;
+  samples.reserve(iterations);
+
+  for (std::size_t i = 0; i < warmup_iterations + iterations; ++i) {
+    auto submitted = clock_type::now();
+    auto future = scheduler.await([]() { return clock_type::now(); });
+    auto started = future.get();
+
+    if (i >= warmup_iterations) {
+      samples.push_back(started - submitted);
+    }
+  }
+
+  std::sort(samples.begin(), samples.end());
+  return samples;
+}
+
+/// Prints the latency distribution for a single wait policy.
+auto report(std::string_view name,
+            const std::vector<clock_type::duration>& samples) -> void {
+  std::printf("%-12.*s %10lld %10lld %10lld %10lld\n",
+              static_cast<int>(name.size()), name.data(),
+              static_cast<long long>(percentile(samples, 0.50).count()),
+              static_cast<long long>(percentile(samples, 0.99).count()),
+              static_cast<long long>(percentile(samples, 0.999).count()),
+              static_cast<long long>(percentile(samples, 1.0).count()));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 0;
+  iterations = iterations > 0 ? iterations : 100000;
+
+  std::printf("submit-to-start latency over %zu tasks (ns)\n", iterations);
+  std::printf("%-12s %10s %10s %10s %10s\n", "policy", "p50", "p99", "p999",
+              "max");
+
+  report("park", measure<rio::wait_policy::park>(iterations));
+  report("spin", measure<rio::wait_policy::spin>(iterations));
+  report("pinned_spin", measure<rio::wait_policy::pinned_spin>(iterations));
+}
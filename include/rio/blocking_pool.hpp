@@ -0,0 +1,94 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "rio/task.hpp"
+
+namespace rio {
+
+/// Default upper bound on the number of threads in a blocking pool.
+constexpr std::size_t max_blocking_threads = 512;
+
+/// Default duration an idle blocking thread waits for work before exiting.
+constexpr std::chrono::milliseconds blocking_keep_alive =
+    std::chrono::seconds(10);
+
+/// Elastically sized pool of threads that executes tasks which may block
+/// (e.g., file I/O, DNS resolution, or legacy synchronous libraries) without
+/// occupying the compute workers.
+class blocking_pool {
+ private:
+  std::deque<rio::task> tasks;
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::condition_variable idle;
+  std::list<std::thread> threads;
+  std::vector<std::thread::id> retired;
+  std::size_t max_threads;
+  std::size_t num_threads;
+  std::size_t num_idle;
+  std::chrono::milliseconds keep_alive;
+  rio::exception_handler on_exception;
+  bool stop;
+
+ private:
+  /// Processes tasks until the pool is stopped or the thread has been idle for
+  /// longer than the keep-alive duration.
+  auto process_work() -> void;
+
+  /// Joins threads which have exited due to inactivity. Expects the mutex to
+  /// be held by the caller.
+  auto reap() -> void;
+
+ public:
+  /// Creates an empty pool which grows up to the specified number of threads
+  /// on demand and shrinks after threads are idle for the keep-alive duration.
+  /// The exception handler receives exceptions which escape fire-and-forget
+  /// tasks.
+  explicit blocking_pool(
+      std::size_t = rio::max_blocking_threads,
+      std::chrono::milliseconds = rio::blocking_keep_alive,
+      rio::exception_handler = {});
+
+  blocking_pool(const blocking_pool&) = delete;
+  auto operator=(const blocking_pool&) -> blocking_pool& = delete;
+
+  /// Stops accepting work, executes all pending tasks, and joins all threads.
+  ~blocking_pool();
+
+  /// Adds a task to the pool's task queue, spawning a new thread if every
+  /// existing thread is busy and the pool has not reached its maximum size.
+  /// Also joins threads which have exited due to inactivity.
+  auto submit(rio::task&&) -> void;
+
+  /// Blocks until the task queue is empty and no thread is executing a task.
+  auto wait_idle() -> void;
+
+  /// Returns true if the task queue is empty and no thread is executing a
+  /// task.
+  auto is_idle() -> bool;
+
+  /// Returns the number of threads currently alive in the pool.
+  auto size() -> std::size_t;
+};
+
+}  // namespace rio
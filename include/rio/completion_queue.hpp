@@ -0,0 +1,241 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include "rio/worker.hpp"
+
+namespace rio {
+
+/// Represents a finished task delivered through a completion queue, holding
+/// the caller-provided tag and either the task's return value or exception.
+template <typename R>
+struct completion {
+  using value_type = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+  using result_type = std::variant<value_type, std::exception_ptr>;
+
+  std::uint64_t tag;   // Tag identifying the task which produced the result.
+  result_type result;  // Return value (index 0) or exception (index 1).
+
+  /// Returns true if the task completed without throwing.
+  auto has_value() const -> bool { return result.index() == 0; }
+
+  /// Returns the task's return value or rethrows the task's exception.
+  auto get() -> R {
+    if (result.index() == 1) {
+      std::rethrow_exception(std::get<1>(result));
+    }
+
+    if constexpr (!std::is_void_v<R>) {
+      return std::move(std::get<0>(result));
+    }
+  }
+};
+
+/// Signals an eventfd when completions become available so that the consumer
+/// can integrate a completion queue into an existing epoll loop. The eventfd
+/// is only written when the signal transitions from cleared to set, so a burst
+/// of completions costs a single write.
+class completion_signal {
+ private:
+  int fd;
+  std::atomic<bool> signalled;
+
+ public:
+  /// Creates an eventfd if enabled and supported by the platform (Linux).
+  explicit completion_signal(bool);
+
+  completion_signal(const completion_signal&) = delete;
+  auto operator=(const completion_signal&) -> completion_signal& = delete;
+
+  /// Closes the eventfd, if any.
+  ~completion_signal();
+
+  /// Makes the eventfd readable if it is not already. Called by producers.
+  auto notify() -> void;
+
+  /// Drains the eventfd and clears the signal. Called by the consumer before
+  /// harvesting completions.
+  auto reset() -> void;
+
+  /// Returns the eventfd's file descriptor, or -1 if notifications are
+  /// disabled or unsupported.
+  auto native_handle() const -> int;
+};
+
+/// Bounded multi-producer, single-consumer ring of completions. Tasks push a
+/// completion record when they finish and a single consumer, such as an event
+/// loop thread, harvests the records in batches without blocking on futures.
+template <typename R>
+class completion_queue {
+ private:
+  /// Ring slot whose sequence number determines whether it is ready to be
+  /// written by a producer or read by the consumer.
+  struct slot {
+    std::atomic<std::size_t> sequence;
+    std::optional<rio::completion<R>> record;
+  };
+
+  std::size_t mask;
+  std::unique_ptr<slot[]> slots;
+  alignas(64) std::atomic<std::size_t> tail;
+  alignas(64) std::size_t head;
+  rio::completion_signal signal;
+
+ private:
+  /// Attempts to push a completion. Returns false if the ring is full.
+  auto try_push(rio::completion<R>& record) -> bool {
+    std::size_t position = tail.load(std::memory_order_relaxed);
+
+    while (true) {
+      slot& s = slots[position & mask];
+      std::size_t sequence = s.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+      if (difference == 0) {
+        // Claim the slot by advancing the tail; retry with the updated tail
+        // if another producer claimed it first
+        if (tail.compare_exchange_weak(position, position + 1,
+                                       std::memory_order_relaxed)) {
+          s.record.emplace(std::move(record));
+          s.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+ public:
+  /// Creates a completion queue holding at least the specified number of
+  /// completions. If notify is true, an eventfd is signalled whenever
+  /// completions become available (Linux only).
+  explicit completion_queue(std::size_t capacity, bool notify = false)
+      : mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1),
+        slots(std::make_unique<slot[]>(mask + 1)),
+        tail(0),
+        head(0),
+        signal(notify) {
+    for (std::size_t i = 0; i <= mask; ++i) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  completion_queue(const completion_queue&) = delete;
+  auto operator=(const completion_queue&) -> completion_queue& = delete;
+
+  /// Pushes a completion, waiting for the consumer to free a slot if the ring
+  /// is full. Safe to call from multiple threads.
+  auto push(rio::completion<R>&& record) -> void {
+    while (!try_push(record)) {
+      if (!rio::worker::help()) {
+        std::this_thread::yield();
+      }
+    }
+
+    signal.notify();
+  }
+
+  /// Invokes a callable, capturing its return value or exception, and pushes
+  /// the result as a completion with the specified tag.
+  template <typename F>
+  auto complete(std::uint64_t tag, F&& function) -> void {
+    using result_type = typename rio::completion<R>::result_type;
+
+    auto record = [&]() -> rio::completion<R> {
+      try {
+        if constexpr (std::is_void_v<R>) {
+          std::invoke(std::forward<F>(function));
+          return {tag, result_type(std::in_place_index<0>)};
+        } else {
+          return {tag, result_type(std::in_place_index<0>,
+                                   std::invoke(std::forward<F>(function)))};
+        }
+      } catch (...) {
+        return {tag,
+                result_type(std::in_place_index<1>, std::current_exception())};
+      }
+    }();
+
+    push(std::move(record));
+  }
+
+  /// Harvests up to max completions, passing each to the consumer callable,
+  /// and returns the number harvested. Must only be called from a single
+  /// consumer thread. If completions remain afterward, the eventfd stays
+  /// readable.
+  template <typename F>
+  auto drain(F&& consumer,
+             std::size_t max = std::numeric_limits<std::size_t>::max())
+      -> std::size_t {
+    signal.reset();
+
+    std::size_t count = 0;
+
+    for (; count < max; ++count) {
+      slot& s = slots[head & mask];
+
+      if (s.sequence.load(std::memory_order_acquire) != head + 1) {
+        break;
+      }
+
+      // Move the record out and release the slot before invoking the consumer
+      // so that producers are not stalled by consumer work
+      rio::completion<R> record = std::move(*s.record);
+      s.record.reset();
+      s.sequence.store(head + mask + 1, std::memory_order_release);
+      ++head;
+
+      consumer(std::move(record));
+    }
+
+    if (!empty()) {
+      signal.notify();
+    }
+
+    return count;
+  }
+
+  /// Returns true if no completions are ready to be harvested. Must only be
+  /// called from the consumer thread.
+  auto empty() const -> bool {
+    return slots[head & mask].sequence.load(std::memory_order_acquire) !=
+           head + 1;
+  }
+
+  /// Returns the number of completions the queue can hold.
+  auto capacity() const -> std::size_t { return mask + 1; }
+
+  /// Returns the eventfd signalled when completions are ready, or -1 if
+  /// notifications are disabled or unsupported.
+  auto native_handle() const -> int { return signal.native_handle(); }
+};
+
+}  // namespace rio
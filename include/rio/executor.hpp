@@ -13,52 +13,171 @@
 
 #pragma once
 
+#include <chrono>
+#include <concepts>
 #include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include "rio/blocking_pool.hpp"
 #include "rio/scheduler.hpp"
 #include "rio/thread_count.hpp"
+#include "rio/wait_policy.hpp"
+#include "rio/watchdog.hpp"
 #include "rio/worker.hpp"
 
 namespace rio {
 
-/// Manages the execution of tasks using a specific scheduler.
+/// Manages the execution of tasks using a specific scheduler. The wait policy
+/// determines whether the master and worker threads park or busy-poll while
+/// idle; schedulers which are not constructible with a wait policy always use
+/// their own waiting strategy.
 template <std::size_t N = rio::hardware_concurrency,
-          rio::constructible_scheduler S = rio::fcfs_scheduler>
+          rio::constructible_scheduler S = rio::fcfs_scheduler,
+          rio::wait_policy W = rio::wait_policy::park>
   requires(N >= 2)
 class executor {
  private:
   S scheduler;
   std::array<rio::worker, N - 1> workers;
+  rio::blocking_pool blocking_workers;
   std::atomic<bool> stop;
+  std::atomic<bool> watched;
+  std::atomic<bool> rebalance;
   std::thread master;
+  std::unique_ptr<rio::watchdog> monitor;
 
  private:
-  /// Continuously retrieves and assigns scheduled tasks to workers.
+  /// Constructs the scheduler, forwarding the wait policy when supported.
+  static auto make_scheduler() -> S {
+    if constexpr (std::constructible_from<S, std::size_t, rio::wait_policy>) {
+      return S(N - 1, W);
+    } else {
+      return S(N - 1);
+    }
+  }
+
+  /// Constructs a single worker with the executor's wait policy and exception
+  /// handler.
+  static auto make_worker(std::size_t, const rio::exception_handler& handler)
+      -> rio::worker {
+    return rio::worker(W, handler);
+  }
+
+  /// Constructs all workers in place, since workers are neither copyable nor
+  /// movable.
+  template <std::size_t... I>
+  static auto make_workers(std::index_sequence<I...>,
+                           const rio::exception_handler& handler)
+      -> std::array<rio::worker, N - 1> {
+    return {make_worker(I, handler)...};
+  }
+
+  /// Returns the specified worker if it is not stalled, otherwise the next
+  /// worker which is not stalled. Returns std::nullopt if all workers are
+  /// stalled.
+  auto healthy_worker(rio::worker_id wid) -> std::optional<rio::worker_id> {
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+      rio::worker_id candidate = (wid + i) % workers.size();
+
+      if (!workers[candidate].is_stalled()) {
+        return candidate;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /// Moves all tasks pending on stalled workers to healthy workers. Tasks are
+  /// left in place if no healthy worker exists.
+  auto migrate_work() -> void {
+    for (auto& worker : workers) {
+      if (worker.is_stalled()) {
+        worker.migrate_to(workers);
+      }
+    }
+  }
+
+  /// Continuously retrieves and assigns scheduled tasks to workers, skipping
+  /// workers flagged as stalled. Tasks marked as blocking are handed off to
+  /// the blocking pool instead.
   auto distribute_work() -> void {
     while (!stop.load() || scheduler.has_tasks()) {
       rio::scheduled_task task = scheduler.next();
-      workers[task.wid].assign(std::move(task.task));
+      rio::worker_id wid = task.wid;
+
+      // Note: stall handling is only paid for once a watchdog has been
+      // started; the relaxed load compiles to a plain load
+      if (watched.load(std::memory_order_relaxed)) {
+        if (rebalance.exchange(false)) {
+          migrate_work();
+        }
+
+        wid = healthy_worker(wid).value_or(wid);
+      }
+
+      if (task.task.is_blocking()) {
+        blocking_workers.submit(std::move(task.task));
+      } else {
+        workers[wid].assign(std::move(task.task));
+      }
     }
   }
 
  public:
   /// Creates and initializes a master thread with work distribution logic.
-  /// Additionally, creates N - 1 worker threads.
-  explicit executor()
-      : scheduler(N - 1), stop(false), master([&]() { distribute_work(); }) {}
+  /// Additionally, creates N - 1 worker threads and an initially empty
+  /// blocking pool. With the pinned spin policy, the master thread is pinned
+  /// to core 0 and each worker to the following cores. The exception handler
+  /// receives exceptions which escape fire-and-forget tasks, and may be
+  /// invoked concurrently from multiple threads.
+  explicit executor(rio::exception_handler on_exception = {})
+      : scheduler(make_scheduler()),
+        workers(make_workers(std::make_index_sequence<N - 1>(), on_exception)),
+        blocking_workers(rio::max_blocking_threads,
+                         rio::blocking_keep_alive,
+                         on_exception),
+        stop(false),
+        watched(false),
+        rebalance(false),
+        master([&]() { distribute_work(); }) {
+    if constexpr (W == rio::wait_policy::pinned_spin) {
+      rio::pin_thread(master, 0);
+
+      for (std::size_t i = 0; i < workers.size(); ++i) {
+        workers[i].pin((i + 1) % rio::hardware_concurrency);
+      }
+    }
+  }
 
   executor(const executor&) = delete;
   auto operator=(const executor&) -> executor& = delete;
 
-  /// Stops work processing logic and joins the master thread and all worker
-  /// threads.
+  /// Stops work processing logic and joins the watchdog thread, the master
+  /// thread, all worker threads, and all blocking pool threads. The master
+  /// thread keeps distributing work until every blocking task scheduled so far
+  /// has finished, so blocking tasks may still submit compute tasks and wait on
+  /// them. Blocking tasks submitted by compute tasks during destruction must
+  /// not do so.
   ~executor() {
+    monitor.reset();
+
+    // Note: a blank task round-trips through the master thread, so once it
+    // completes every task scheduled before it has been handed off (assuming
+    // a FIFO scheduler). Repeat until no blocking task remains which could
+    // submit more work.
+    do {
+      blocking_workers.wait_idle();
+      scheduler.await([]() {}).wait();
+    } while (scheduler.has_tasks() || !blocking_workers.is_idle());
+
     stop.store(true);
 
     // Note: if the master thread is blocked by the next call and the scheduler
     // is empty (i.e., has no tasks to schedule), then submit a blank task to
     // allow the master thread to pass through the next call
     if (!scheduler.has_tasks()) {
-      scheduler.await([]() {});
+      scheduler.spawn([]() {});
     }
 
     if (master.joinable()) {
@@ -68,6 +187,42 @@ class executor {
 
   /// Exposes a mutable reference to the task scheduler.
   constexpr auto get_scheduler() -> S& { return scheduler; }
+
+  /// Exposes a mutable reference to the blocking pool.
+  constexpr auto get_blocking_pool() -> rio::blocking_pool& {
+    return blocking_workers;
+  }
+
+  /// Starts a watchdog which detects workers whose current task has been
+  /// running for longer than the threshold. Each stall is reported to the
+  /// handler, no further tasks are assigned to the stalled worker until its
+  /// task finishes, and tasks already pending on it are moved to healthy
+  /// workers. Replaces any previously started watchdog. Until the first call,
+  /// task distribution performs no stall handling.
+  auto watch(std::chrono::nanoseconds threshold,
+             rio::stall_handler on_stall = {}) -> void {
+    monitor.reset();
+    watched.store(true, std::memory_order_relaxed);
+    monitor = std::make_unique<rio::watchdog>(
+        workers, threshold,
+        [this, on_stall = std::move(on_stall)](
+            rio::worker_id wid, std::chrono::nanoseconds elapsed) {
+          // Submit a blank task to wake the master thread so that pending
+          // tasks are migrated even if no new tasks are submitted
+          rebalance.store(true);
+          scheduler.spawn([]() {});
+
+          if (on_stall) {
+            on_stall(wid, elapsed);
+          }
+        });
+  }
+
+  /// Returns the number of stalls detected since the watchdog was started, or
+  /// zero if no watchdog is running.
+  auto stall_count() const -> std::size_t {
+    return monitor ? monitor->stall_count() : 0;
+  }
 };
 
 }  // namespace rio
@@ -16,10 +16,14 @@
 #include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <future>
+#include <mutex>
 #include <semaphore>
 #include <utility>
+#include "rio/completion_queue.hpp"
 #include "rio/task.hpp"
+#include "rio/wait_policy.hpp"
 #include "rio/worker.hpp"
 
 namespace rio {
@@ -60,6 +64,49 @@ class scheduler {
     schedule(std::move(task));
     return std::move(future);
   }
+
+  /// Submits a fire-and-forget task for execution. No future is created;
+  /// exceptions thrown by the task are passed to the executor's exception
+  /// handler instead.
+  template <typename F, typename... A>
+  auto spawn(F&& function, A&&... arguments) -> void {
+    schedule(rio::task::make_detached(std::forward<F>(function),
+                                      std::forward<A>(arguments)...));
+  }
+
+  /// Submits a task whose return value or exception is pushed to a completion
+  /// queue, tagged with the specified tag, instead of being delivered through
+  /// a future. Allows threads which cannot block on futures, such as event
+  /// loops, to harvest results in batches.
+  template <typename R, typename F, typename... A>
+    requires std::is_invocable_r_v<R, std::decay_t<F>, std::decay_t<A>...>
+  auto await_into(rio::completion_queue<R>& queue,
+                  std::uint64_t tag,
+                  F&& function,
+                  A&&... arguments) -> void {
+    spawn([&queue, tag, function = std::forward<F>(function),
+           ... arguments = std::forward<A>(arguments)]() mutable {
+      queue.complete(tag,
+                     [&]() -> R { return std::invoke(function, arguments...); });
+    });
+  }
+
+  /// Submits a task which may block for an arbitrary amount of time (e.g.,
+  /// file I/O) and returns a future containing the task's return value or
+  /// exception. The task is marked as blocking so that the executor offloads
+  /// it to its blocking pool instead of a compute worker.
+  template <
+      typename F,
+      typename... A,
+      typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
+  auto spawn_blocking(F&& function, A&&... arguments) -> std::future<R> {
+    auto [future, task] = rio::task::make(std::forward<F>(function),
+                                          std::forward<A>(arguments)...);
+
+    task.mark_blocking();
+    schedule(std::move(task));
+    return std::move(future);
+  }
 };
 
 /// Validates if a type S is derived from scheduler and constructible with a
@@ -72,23 +119,30 @@ concept constructible_scheduler =
 class fcfs_scheduler : public rio::scheduler {
  private:
   folly::ProducerConsumerQueue<rio::task> tasks;
+  std::mutex producer;
   std::binary_semaphore ready;
   rio::worker_id prev_wid;
   rio::worker_id max_wid;
+  rio::wait_policy policy;
 
  protected:
-  /// Schedules a task using a FCFS approach.
+  /// Schedules a task using a FCFS approach. Safe to call from multiple
+  /// threads, including worker threads submitting nested tasks.
   auto schedule(rio::task&&) -> void override;
 
  public:
-  /// Constructs a FCFS scheduler for a specified number of workers.
-  explicit fcfs_scheduler(std::size_t);
+  /// Constructs a FCFS scheduler for a specified number of workers. The wait
+  /// policy determines whether next() parks or busy-polls while the queue is
+  /// empty.
+  explicit fcfs_scheduler(std::size_t,
+                          rio::wait_policy = rio::wait_policy::park);
 
   /// Returns true if there are tasks in the scheduler's queue.
   auto has_tasks() const -> bool override;
 
   /// Retrieves and prepares the next task for execution, determining the
-  /// appropriate worker ID. Blocks until a task is ready to be scheduled.
+  /// appropriate worker ID. Blocks (or spins) until a task is ready to be
+  /// scheduled.
   auto next() -> rio::scheduled_task override;
 };
 
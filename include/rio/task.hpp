@@ -14,11 +14,16 @@
 #pragma once
 
 #include <atomic>
+#include <exception>
 #include <functional>
 #include <future>
 
 namespace rio {
 
+/// Receives exceptions which escape fire-and-forget tasks. An empty handler
+/// discards such exceptions.
+using exception_handler = std::function<void(std::exception_ptr)>;
+
 /// Forward declaration of the task closure struct to be used in task::make().
 template <typename R>
 struct task_closure;
@@ -28,6 +33,7 @@ class task {
  private:
   std::function<void()> propagator;
   std::atomic<bool> executed;
+  bool blocking;
 
  private:
   /// Receives a propagator function built by task::make() and stores it as a
@@ -77,11 +83,29 @@ class task {
     return {std::move(future), std::move(task(std::move(propagater)))};
   }
 
+  /// Constructs a fire-and-forget task from a callable and its arguments.
+  /// Unlike task::make(), no promise or future is created, so any exception
+  /// thrown by the callable propagates out of the task's invocation.
+  template <typename F, typename... A>
+  static auto make_detached(F&& function, A&&... arguments) -> rio::task {
+    return task([function = std::forward<F>(function),
+                 ... arguments = std::forward<A>(arguments)]() mutable {
+      std::invoke(function, arguments...);
+    });
+  }
+
   /// Executes the encapsulated callable if it has not been executed already.
   auto operator()() -> void;
 
   /// Returns whether or not the callable can be executed now.
   auto is_executable() const -> bool;
+
+  /// Marks the task as potentially blocking, so that executors run it on a
+  /// blocking pool rather than on a compute worker.
+  auto mark_blocking() -> void;
+
+  /// Returns whether or not the task has been marked as blocking.
+  auto is_blocking() const -> bool;
 };
 
 /// Represents a task and its associated future. The future holds the result
@@ -0,0 +1,85 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include "rio/scheduler.hpp"
+
+namespace rio {
+
+/// Runs a dynamic set of subtasks and waits for all of them at once. Subtasks
+/// share a single completion counter rather than a future each, so fan-out and
+/// fan-in over many subtasks costs one synchronization point. run() must not
+/// be called concurrently with wait(), except from the group's own subtasks.
+class task_group {
+ private:
+  rio::scheduler& scheduler;
+  std::atomic<std::size_t> pending;
+  std::atomic<bool> failed;
+  std::exception_ptr exception;
+  std::mutex mutex;
+  std::condition_variable done;
+  bool finished;
+
+ private:
+  /// Records the exception of a failed subtask if no other subtask has failed
+  /// since the last wait.
+  auto fail(std::exception_ptr) -> void;
+
+  /// Marks a subtask as complete, waking the waiter if it was the last one.
+  auto complete() -> void;
+
+ public:
+  /// Creates an empty task group which submits subtasks to the scheduler.
+  explicit task_group(rio::scheduler&);
+
+  task_group(const task_group&) = delete;
+  auto operator=(const task_group&) -> task_group& = delete;
+
+  /// Waits for all remaining subtasks, discarding any captured exception.
+  ~task_group();
+
+  /// Submits a subtask to the group's scheduler. Must not be called
+  /// concurrently with wait(), except from the group's own subtasks.
+  template <typename F, typename... A>
+  auto run(F&& function, A&&... arguments) -> void {
+    pending.fetch_add(1, std::memory_order_relaxed);
+
+    scheduler.spawn([this, function = std::forward<F>(function),
+                     ... arguments = std::forward<A>(arguments)]() mutable {
+      try {
+        std::invoke(function, arguments...);
+      } catch (...) {
+        fail(std::current_exception());
+      }
+
+      complete();
+    });
+  }
+
+  /// Waits until all subtasks submitted so far have completed, then rethrows
+  /// the first exception thrown by any of them. When called from a worker
+  /// thread, executes the worker's own queued tasks (but never those of other
+  /// workers) while waiting. The group may be reused after waiting, but wait()
+  /// must only be called by one thread at a time.
+  auto wait() -> void;
+};
+
+}  // namespace rio
@@ -0,0 +1,56 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include "rio/worker.hpp"
+
+namespace rio {
+
+/// Duration a worker thread waits on a result before checking its task queue
+/// again when it has no queued tasks to help with.
+constexpr std::chrono::microseconds help_interval(50);
+
+/// Waits until the result of a std::future or std::shared_future is ready.
+/// When called from a worker thread, executes the worker's queued tasks while
+/// waiting instead of blocking it, so that nested fork-join code neither
+/// deadlocks nor leaves the pool idle. Only the calling worker's own queue is
+/// drained; tasks queued on other workers are never stolen, so a result which
+/// depends on a task assigned to a blocked or stalled worker is still delayed
+/// until that worker runs it.
+template <typename F>
+auto wait(const F& future) -> void {
+  if (!rio::worker::is_worker_thread()) {
+    future.wait();
+    return;
+  }
+
+  while (future.wait_for(std::chrono::seconds(0)) !=
+         std::future_status::ready) {
+    if (!rio::worker::help()) {
+      future.wait_for(rio::help_interval);
+    }
+  }
+}
+
+/// Waits until the result of a future is ready, helping with queued tasks as
+/// described by rio::wait(), and returns the result or rethrows the exception.
+template <typename R>
+auto get(std::future<R>& future) -> R {
+  rio::wait(future);
+  return future.get();
+}
+
+}  // namespace rio
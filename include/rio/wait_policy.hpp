@@ -0,0 +1,50 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace rio {
+
+/// Determines how idle executor threads wait for new work.
+enum class wait_policy {
+  park,         // Block on a semaphore until work is signalled.
+  spin,         // Busy-poll task queues with CPU pause hints.
+  pinned_spin,  // Busy-poll task queues from threads pinned to dedicated cores.
+};
+
+/// Returns whether or not the policy busy-polls instead of parking.
+constexpr auto is_spinning(rio::wait_policy policy) -> bool {
+  return policy != rio::wait_policy::park;
+}
+
+/// Hints to the processor that the calling thread is in a spin-wait loop.
+inline auto cpu_relax() -> void {
+#if defined(__x86_64__) || defined(__i386__)
+  _mm_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+/// Pins a thread to the specified core. Returns false if the platform does not
+/// support thread affinity or the core is unavailable.
+auto pin_thread(std::thread&, std::size_t) -> bool;
+
+}  // namespace rio
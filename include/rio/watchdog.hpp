@@ -0,0 +1,68 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include "rio/worker.hpp"
+
+namespace rio {
+
+/// Receives the ID of a worker whose current task has exceeded the stall
+/// threshold, along with how long the task has been running.
+using stall_handler =
+    std::function<void(rio::worker_id, std::chrono::nanoseconds)>;
+
+/// Monitors workers from a dedicated thread and reports workers whose current
+/// task has been running for longer than a configurable threshold. Stalled
+/// workers are flagged so that no further tasks are assigned to them.
+class watchdog {
+ private:
+  std::span<rio::worker> workers;
+  std::chrono::nanoseconds threshold;
+  rio::stall_handler on_stall;
+  std::atomic<std::size_t> stalls;
+  std::binary_semaphore stop;
+  std::thread thread;
+
+ private:
+  /// Periodically checks every worker for stalls until the watchdog is
+  /// stopped.
+  auto monitor() -> void;
+
+ public:
+  /// Enables monitoring on the workers, then creates and initializes a
+  /// watchdog thread which monitors them, invoking the stall handler once for
+  /// every task which exceeds the threshold.
+  explicit watchdog(std::span<rio::worker>,
+                    std::chrono::nanoseconds,
+                    rio::stall_handler = {});
+
+  watchdog(const watchdog&) = delete;
+  auto operator=(const watchdog&) -> watchdog& = delete;
+
+  /// Stops monitoring, joins the watchdog thread, and clears the workers'
+  /// stall flags.
+  ~watchdog();
+
+  /// Returns the total number of stalls detected.
+  auto stall_count() const -> std::size_t;
+};
+
+}  // namespace rio
@@ -14,11 +14,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <semaphore>
+#include <span>
 #include <thread>
 #include "folly/ProducerConsumerQueue.h"
 #include "rio/task.hpp"
+#include "rio/wait_policy.hpp"
 
 namespace rio {
 
@@ -29,17 +32,38 @@ using worker_id = std::size_t;
 class worker {
  private:
   folly::ProducerConsumerQueue<rio::task> tasks;
+  std::atomic_flag claiming;
   std::binary_semaphore ready;
   std::atomic<bool> stop;
+  std::atomic<bool> stalled;
+  std::atomic<bool> monitored;
+  std::atomic<std::chrono::steady_clock::rep> busy_since;
+  rio::wait_policy policy;
+  rio::exception_handler on_exception;
   std::thread thread;
 
+  /// Worker owning the calling thread, or nullptr for non-worker threads.
+  static thread_local rio::worker* current;
+
  private:
   /// Processes all work in the task queue.
   auto process_work() -> void;
 
+  /// Executes the next task in the task queue, if any. Must only be called
+  /// from the worker's own thread.
+  auto process_next() -> bool;
+
+  /// Executes a task, passing any exception which escapes it to the exception
+  /// handler.
+  auto run(rio::task&) -> void;
+
  public:
-  /// Creates and initializes a worker thread with work processing logic.
-  explicit worker();
+  /// Creates and initializes a worker thread with work processing logic. The
+  /// wait policy determines whether the thread parks or busy-polls while its
+  /// task queue is empty, and the exception handler receives exceptions which
+  /// escape fire-and-forget tasks.
+  explicit worker(rio::wait_policy = rio::wait_policy::park,
+                  rio::exception_handler = {});
 
   worker(const worker&) = delete;
   auto operator=(const worker&) -> worker& = delete;
@@ -55,8 +79,51 @@ class worker {
       std::this_thread::yield();
     }
 
-    ready.release();  // Signal that tasks are ready to be executed
+    // Signal that tasks are ready to be executed; spinning workers poll the
+    // queue directly, so skip the wakeup
+    if (!rio::is_spinning(policy)) {
+      ready.release();
+    }
   }
+
+  /// Pins the worker thread to the specified core. Returns false if pinning is
+  /// unsupported or failed.
+  auto pin(std::size_t) -> bool;
+
+  /// Enables tracking of the worker's running time for stall detection.
+  /// Tracking costs a clock read and a spinlock per task, so it is disabled
+  /// until a watchdog monitors the worker. Once enabled, it stays enabled.
+  auto enable_monitoring() -> void;
+
+  /// Returns how long the worker's current task has been running, or zero if
+  /// the worker is idle or not monitored.
+  auto running_for() const -> std::chrono::nanoseconds;
+
+  /// Returns true if the worker is running a task. Always false if the worker
+  /// is not monitored.
+  auto is_busy() const -> bool;
+
+  /// Sets whether the worker is considered stalled, such that no further tasks
+  /// should be assigned to it. Returns the previous value. The flag is cleared
+  /// automatically once the worker finishes its current task.
+  auto set_stalled(bool) -> bool;
+
+  /// Returns true if the worker is considered stalled.
+  auto is_stalled() const -> bool;
+
+  /// Moves all tasks pending in the worker's task queue to the other workers
+  /// which are not stalled, leaving them in place if no such worker exists.
+  /// Must only be called from the thread which assigns tasks to the workers.
+  auto migrate_to(std::span<rio::worker>) -> void;
+
+  /// Returns true if the calling thread is a worker thread.
+  static auto is_worker_thread() -> bool;
+
+  /// Executes one task queued on the calling thread's worker, allowing tasks
+  /// which wait on other tasks to make progress instead of blocking the
+  /// worker. Tasks queued on other workers are never taken. Returns false if
+  /// the calling thread is not a worker thread or its queue is empty.
+  static auto help() -> bool;
 };
 
 }  // namespace rio
@@ -0,0 +1,131 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/blocking_pool.hpp"
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+auto rio::blocking_pool::process_work() -> void {
+  std::unique_lock lock(mutex);
+
+  while (ready.wait_for(lock, keep_alive,
+                        [&]() { return stop || !tasks.empty(); }) &&
+         !tasks.empty()) {
+    auto task = std::move(tasks.front());
+    tasks.pop_front();
+    --num_idle;
+
+    // Note: release the lock while the task runs, since blocking tasks are
+    // expected to hold the thread for an arbitrary amount of time
+    lock.unlock();
+
+    try {
+      std::invoke(std::move(task));
+    } catch (...) {
+      if (on_exception) {
+        on_exception(std::current_exception());
+      }
+    }
+
+    lock.lock();
+
+    if (++num_idle == num_threads && tasks.empty()) {
+      idle.notify_all();
+    }
+  }
+
+  // Either the pool is stopping and drained, or the thread timed out while
+  // idle; in both cases leave the thread to be joined by its owner
+  --num_idle;
+  --num_threads;
+  retired.push_back(std::this_thread::get_id());
+}
+
+auto rio::blocking_pool::reap() -> void {
+  for (auto id : retired) {
+    auto thread = std::find_if(threads.begin(), threads.end(),
+                               [&](auto& t) { return t.get_id() == id; });
+
+    if (thread != threads.end()) {
+      thread->join();
+      threads.erase(thread);
+    }
+  }
+
+  retired.clear();
+}
+
+rio::blocking_pool::blocking_pool(std::size_t max_threads,
+                                  std::chrono::milliseconds keep_alive,
+                                  rio::exception_handler on_exception)
+    : max_threads(std::max<std::size_t>(max_threads, 1)),
+      num_threads(0),
+      num_idle(0),
+      keep_alive(keep_alive),
+      on_exception(std::move(on_exception)),
+      stop(false) {}
+
+rio::blocking_pool::~blocking_pool() {
+  std::list<std::thread> remaining;
+
+  {
+    std::lock_guard lock(mutex);
+    stop = true;
+    remaining = std::move(threads);
+  }
+
+  ready.notify_all();
+
+  for (auto& thread : remaining) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+auto rio::blocking_pool::submit(rio::task&& task) -> void {
+  {
+    std::lock_guard lock(mutex);
+    tasks.push_back(std::move(task));
+
+    // Join threads which retired after the keep-alive on every submission, so
+    // their stacks are released even if the pool does not grow again
+    reap();
+
+    // Grow the pool only when the backlog exceeds the number of idle threads,
+    // so bursts of blocking work never queue behind each other
+    if (tasks.size() > num_idle && num_threads < max_threads) {
+      ++num_threads;
+      ++num_idle;
+      threads.emplace_back([&]() { process_work(); });
+    }
+  }
+
+  ready.notify_one();
+}
+
+auto rio::blocking_pool::wait_idle() -> void {
+  std::unique_lock lock(mutex);
+  idle.wait(lock, [&]() { return tasks.empty() && num_idle == num_threads; });
+}
+
+auto rio::blocking_pool::is_idle() -> bool {
+  std::lock_guard lock(mutex);
+  return tasks.empty() && num_idle == num_threads;
+}
+
+auto rio::blocking_pool::size() -> std::size_t {
+  std::lock_guard lock(mutex);
+  return num_threads;
+}
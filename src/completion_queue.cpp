@@ -0,0 +1,64 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/completion_queue.hpp"
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+rio::completion_signal::completion_signal(bool enabled)
+    : fd(-1), signalled(false) {
+#if defined(__linux__)
+  if (enabled) {
+    fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  }
+#else
+  (void)enabled;
+#endif
+}
+
+rio::completion_signal::~completion_signal() {
+#if defined(__linux__)
+  if (fd >= 0) {
+    close(fd);
+  }
+#endif
+}
+
+auto rio::completion_signal::notify() -> void {
+#if defined(__linux__)
+  if (fd >= 0 && !signalled.exchange(true, std::memory_order_acq_rel)) {
+    std::uint64_t value = 1;
+    [[maybe_unused]] auto written = write(fd, &value, sizeof(value));
+  }
+#endif
+}
+
+auto rio::completion_signal::reset() -> void {
+#if defined(__linux__)
+  if (fd >= 0) {
+    // Note: drain the eventfd before clearing the signal, so a producer which
+    // observes the cleared signal always makes the eventfd readable again
+    std::uint64_t value;
+    [[maybe_unused]] auto bytes = read(fd, &value, sizeof(value));
+    signalled.exchange(false, std::memory_order_acq_rel);
+  }
+#endif
+}
+
+auto rio::completion_signal::native_handle() const -> int {
+  return fd;
+}
@@ -12,21 +12,42 @@
 // all copies or substantial portions of the Software.
 
 #include "rio/scheduler.hpp"
+#include <mutex>
 #include <thread>
 #include "rio/thread_count.hpp"
 
-rio::fcfs_scheduler::fcfs_scheduler(std::size_t num_workers)
+rio::fcfs_scheduler::fcfs_scheduler(std::size_t num_workers,
+                                    rio::wait_policy policy)
     : tasks(rio::hardware_concurrency),
       ready(0),
       prev_wid(0),
-      max_wid(num_workers) {}
+      max_wid(num_workers),
+      policy(policy) {}
 
 auto rio::fcfs_scheduler::schedule(rio::task&& task) -> void {
-  while (!tasks.write(std::move(task))) {
-    std::this_thread::yield();
+  // Note: the task queue is single-producer, so serialize producers. The lock
+  // is released between attempts so that a worker thread blocked on a full
+  // queue can run its own queued tasks, which may themselves schedule tasks,
+  // rather than deadlocking with the master thread assigning to it.
+  while (true) {
+    {
+      std::lock_guard lock(producer);
+
+      if (tasks.write(std::move(task))) {
+        break;
+      }
+    }
+
+    if (!rio::worker::help()) {
+      std::this_thread::yield();
+    }
   }
 
-  ready.release();  // Signal that tasks are ready to be scheduled
+  // Signal that tasks are ready to be scheduled; a spinning scheduler polls
+  // the queue directly, so skip the wakeup
+  if (!rio::is_spinning(policy)) {
+    ready.release();
+  }
 }
 
 auto rio::fcfs_scheduler::has_tasks() const -> bool {
@@ -34,7 +55,14 @@ auto rio::fcfs_scheduler::has_tasks() const -> bool {
 }
 
 auto rio::fcfs_scheduler::next() -> rio::scheduled_task {
-  ready.acquire();  // Wait until tasks are ready to be scheduled
+  // Wait until tasks are ready to be scheduled
+  if (rio::is_spinning(policy)) {
+    while (tasks.isEmpty()) {
+      rio::cpu_relax();
+    }
+  } else {
+    ready.acquire();
+  }
 
   // Claim the next task from task queue and, since task queue size is bounded,
   // immediately pop before distribution to avoid starving producer.
@@ -17,17 +17,19 @@
 #include <utility>
 
 rio::task::task(std::function<void()> propagator)
-    : propagator(propagator), executed(false) {}
+    : propagator(propagator), executed(false), blocking(false) {}
 
 rio::task::task(task&& other) noexcept
     : propagator(std::exchange(other.propagator, nullptr)),
-      executed(other.executed.load()) {
+      executed(other.executed.load()),
+      blocking(other.blocking) {
   other.executed.store(true);
 }
 
 auto rio::task::operator=(task&& other) noexcept -> rio::task& {
   propagator = std::exchange(other.propagator, nullptr);
   executed.store(other.executed.load());
+  blocking = other.blocking;
   other.executed.store(true);
   return *this;
 }
@@ -43,3 +45,11 @@ auto rio::task::operator()() -> void {
 auto rio::task::is_executable() const -> bool {
   return !executed.load();
 }
+
+auto rio::task::mark_blocking() -> void {
+  blocking = true;
+}
+
+auto rio::task::is_blocking() const -> bool {
+  return blocking;
+}
@@ -0,0 +1,81 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/task_group.hpp"
+#include <mutex>
+#include <utility>
+#include "rio/wait.hpp"
+#include "rio/worker.hpp"
+
+auto rio::task_group::fail(std::exception_ptr e) -> void {
+  if (!failed.exchange(true, std::memory_order_relaxed)) {
+    exception = std::move(e);
+  }
+}
+
+auto rio::task_group::complete() -> void {
+  // Note: the counter holds an extra reference owned by wait(), so it only
+  // reaches zero here once wait() has released its reference. The waiter
+  // cannot return (and destroy the group) until it observes the finished flag
+  // under the mutex, which makes the final decrement and the wakeup a single
+  // synchronized step.
+  if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard lock(mutex);
+    finished = true;
+    done.notify_all();
+  }
+}
+
+rio::task_group::task_group(rio::scheduler& scheduler)
+    : scheduler(scheduler), pending(1), failed(false), finished(false) {}
+
+rio::task_group::~task_group() {
+  try {
+    wait();
+  } catch (...) {
+    // Exceptions are only observable through an explicit wait
+  }
+}
+
+auto rio::task_group::wait() -> void {
+  // Release the waiter's reference; if it was the last one, every subtask has
+  // completed without needing to notify
+  if (pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    std::unique_lock lock(mutex);
+
+    if (rio::worker::is_worker_thread()) {
+      // Note: a worker must not park indefinitely here, since the remaining
+      // subtasks may be queued on this worker
+      while (!finished) {
+        lock.unlock();
+        bool helped = rio::worker::help();
+        lock.lock();
+
+        if (!helped) {
+          done.wait_for(lock, rio::help_interval, [&]() { return finished; });
+        }
+      }
+    } else {
+      done.wait(lock, [&]() { return finished; });
+    }
+
+    finished = false;
+  }
+
+  pending.store(1, std::memory_order_relaxed);
+
+  if (failed.load(std::memory_order_relaxed)) {
+    failed.store(false, std::memory_order_relaxed);
+    std::rethrow_exception(std::exchange(exception, nullptr));
+  }
+}
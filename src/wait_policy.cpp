@@ -0,0 +1,41 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/wait_policy.hpp"
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+auto rio::pin_thread(std::thread& thread, std::size_t core) -> bool {
+#if defined(__linux__)
+  if (core >= CPU_SETSIZE) {
+    return false;
+  }
+
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(core, &cpus);
+
+  return pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t),
+                                &cpus) == 0;
+#else
+  // Note: macOS only exposes affinity tags as scheduling hints, so pinning is
+  // treated as unsupported on other platforms
+  (void)thread;
+  (void)core;
+  return false;
+#endif
+}
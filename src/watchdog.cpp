@@ -0,0 +1,79 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/watchdog.hpp"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+auto rio::watchdog::monitor() -> void {
+  // Poll several times per threshold so stalls are detected promptly
+  auto interval = std::max<std::chrono::nanoseconds>(
+      threshold / 4, std::chrono::microseconds(100));
+
+  while (!stop.try_acquire_for(interval)) {
+    for (rio::worker_id wid = 0; wid < workers.size(); ++wid) {
+      auto elapsed = workers[wid].running_for();
+
+      if (elapsed >= threshold) {
+        if (!workers[wid].set_stalled(true)) {
+          stalls.fetch_add(1, std::memory_order_relaxed);
+
+          if (on_stall) {
+            on_stall(wid, elapsed);
+          }
+        }
+      } else if (!workers[wid].is_busy()) {
+        // Note: the worker clears its own flag when the stalled task finishes,
+        // but it may have been flagged just after finishing. The flag is kept
+        // while a stalled task runs shorter nested tasks (i.e., when helping),
+        // so the stalled task is only reported once.
+        workers[wid].set_stalled(false);
+      }
+    }
+  }
+}
+
+rio::watchdog::watchdog(std::span<rio::worker> workers,
+                        std::chrono::nanoseconds threshold,
+                        rio::stall_handler on_stall)
+    : workers(workers),
+      threshold(threshold),
+      on_stall(std::move(on_stall)),
+      stalls(0),
+      stop(0),
+      thread() {
+  for (auto& worker : workers) {
+    worker.enable_monitoring();
+  }
+
+  thread = std::thread([&]() { monitor(); });
+}
+
+rio::watchdog::~watchdog() {
+  stop.release();
+
+  if (thread.joinable()) {
+    thread.join();
+  }
+
+  // Note: monitoring stays enabled on the workers, but no worker should be
+  // skipped once nothing clears their stall flags
+  for (auto& worker : workers) {
+    worker.set_stalled(false);
+  }
+}
+
+auto rio::watchdog::stall_count() const -> std::size_t {
+  return stalls.load(std::memory_order_relaxed);
+}
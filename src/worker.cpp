@@ -12,28 +12,103 @@
 // all copies or substantial portions of the Software.
 
 #include "rio/worker.hpp"
+#include <chrono>
 #include <thread>
+#include <span>
+#include <utility>
 #include "rio/thread_count.hpp"
 
+thread_local rio::worker* rio::worker::current = nullptr;
+
 auto rio::worker::process_work() -> void {
+  current = this;
+
   while (!stop.load()) {
-    ready.acquire();  // Wait until tasks are ready to be executed
-
-    while (!tasks.isEmpty()) {
-      // Claim the next task from task queue and, since task queue size is
-      // bounded, immediately pop before invocation to avoid starving
-      // producer.
-      auto task = std::move(*tasks.frontPtr());
-      tasks.popFront();
-      std::invoke(std::move(task));
+    // Wait until tasks are ready to be executed
+    if (rio::is_spinning(policy)) {
+      while (tasks.isEmpty() && !stop.load()) {
+        rio::cpu_relax();
+      }
+    } else {
+      ready.acquire();
+    }
+
+    while (process_next()) {
+    }
+  }
+}
+
+auto rio::worker::process_next() -> bool {
+  // Note: stall detection is only paid for once a watchdog monitors this
+  // worker. Pending tasks may then be taken by the master thread while this
+  // worker is stalled, so the consumer side of the task queue is guarded by a
+  // spinlock. A worker only stalls while running a task it started after the
+  // flag was set, and the flag is never cleared, so unguarded pops never race
+  // with the master thread.
+  bool monitored = this->monitored.load(std::memory_order_relaxed);
+
+  if (monitored) {
+    while (claiming.test_and_set(std::memory_order_acquire)) {
+      rio::cpu_relax();
+    }
+  }
+
+  if (tasks.isEmpty()) {
+    if (monitored) {
+      claiming.clear(std::memory_order_release);
+    }
+
+    return false;
+  }
+
+  // Claim the next task from task queue and, since task queue size is bounded,
+  // immediately pop before invocation to avoid starving producer.
+  auto task = std::move(*tasks.frontPtr());
+  tasks.popFront();
+
+  if (!monitored) {
+    run(task);
+    return true;
+  }
+
+  claiming.clear(std::memory_order_release);
+
+  // Record the start time for stall detection, restoring the start time of
+  // any task this one was nested in (i.e., when helping) afterward
+  auto started = busy_since.exchange(
+      std::chrono::steady_clock::now().time_since_epoch().count(),
+      std::memory_order_relaxed);
+
+  run(task);
+  busy_since.store(started, std::memory_order_relaxed);
+
+  if (started == 0) {
+    stalled.store(false);
+  }
+
+  return true;
+}
+
+auto rio::worker::run(rio::task& task) -> void {
+  try {
+    std::invoke(std::move(task));
+  } catch (...) {
+    if (on_exception) {
+      on_exception(std::current_exception());
     }
   }
 }
 
-rio::worker::worker()
+rio::worker::worker(rio::wait_policy policy,
+                    rio::exception_handler on_exception)
     : tasks(rio::hardware_concurrency),
       ready(0),
       stop(false),
+      stalled(false),
+      monitored(false),
+      busy_since(0),
+      policy(policy),
+      on_exception(std::move(on_exception)),
       thread([&]() { process_work(); }) {}
 
 rio::worker::~worker() {
@@ -44,3 +119,79 @@ rio::worker::~worker() {
     thread.join();
   }
 }
+
+auto rio::worker::pin(std::size_t core) -> bool {
+  return rio::pin_thread(thread, core);
+}
+
+auto rio::worker::running_for() const -> std::chrono::nanoseconds {
+  auto since = busy_since.load(std::memory_order_relaxed);
+
+  if (since == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+
+  auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+  return std::chrono::steady_clock::duration(now - since);
+}
+
+auto rio::worker::enable_monitoring() -> void {
+  monitored.store(true);
+}
+
+auto rio::worker::is_busy() const -> bool {
+  return busy_since.load(std::memory_order_relaxed) != 0;
+}
+
+auto rio::worker::set_stalled(bool value) -> bool {
+  return stalled.exchange(value);
+}
+
+auto rio::worker::is_stalled() const -> bool {
+  return stalled.load();
+}
+
+auto rio::worker::migrate_to(std::span<rio::worker> workers) -> void {
+  while (claiming.test_and_set(std::memory_order_acquire)) {
+    rio::cpu_relax();
+  }
+
+  // Spread the pending tasks across the healthy workers, starting after this
+  // worker, and leave them in place if no healthy worker exists
+  std::size_t self = 0;
+  while (self < workers.size() && &workers[self] != this) {
+    ++self;
+  }
+
+  std::size_t target = self;
+
+  while (!tasks.isEmpty()) {
+    std::size_t i = 1;
+
+    for (; i <= workers.size(); ++i) {
+      std::size_t candidate = (target + i) % workers.size();
+
+      if (&workers[candidate] != this && !workers[candidate].is_stalled()) {
+        target = candidate;
+        break;
+      }
+    }
+
+    if (i > workers.size()) {
+      break;
+    }
+
+    workers[target].assign(std::move(*tasks.frontPtr()));
+    tasks.popFront();
+  }
+
+  claiming.clear(std::memory_order_release);
+}
+
+auto rio::worker::is_worker_thread() -> bool {
+  return current != nullptr;
+}
+
+auto rio::worker::help() -> bool {
+  return current != nullptr && current->process_next();
+}
@@ -0,0 +1,125 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/blocking_pool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <latch>
+#include <thread>
+#include <vector>
+#include "rio/task.hpp"
+
+class blocking_pool_test : public ::testing::Test {
+ protected:
+  rio::blocking_pool pool;
+};
+
+TEST_F(blocking_pool_test, BlockingPoolExecutesSingleTask) {
+  auto task_closure = rio::task::make([]() { return 42; });
+
+  pool.submit(std::move(task_closure.task));
+  EXPECT_EQ(task_closure.future.get(), 42);
+}
+
+TEST_F(blocking_pool_test, BlockingPoolStartsEmpty) {
+  EXPECT_EQ(pool.size(), 0);
+}
+
+TEST_F(blocking_pool_test, BlockingPoolGrowsForConcurrentBlockingTasks) {
+  // Every task blocks until all of them have started, which only completes if
+  // the pool runs each task on its own thread
+  constexpr std::size_t num_tasks = 16;
+  std::latch started(num_tasks);
+  std::vector<std::future<void>> futures;
+
+  for (std::size_t i = 0; i < num_tasks; ++i) {
+    auto task_closure =
+        rio::task::make([&started]() { started.arrive_and_wait(); });
+
+    pool.submit(std::move(task_closure.task));
+    futures.push_back(std::move(task_closure.future));
+  }
+
+  for (auto& future : futures) {
+    future.get();
+  }
+
+  EXPECT_GE(pool.size(), num_tasks);
+}
+
+TEST_F(blocking_pool_test, BlockingPoolRespectsMaximumSize) {
+  rio::blocking_pool bounded_pool(2);
+  std::vector<std::future<void>> futures;
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    auto task_closure = rio::task::make([]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    });
+
+    bounded_pool.submit(std::move(task_closure.task));
+    futures.push_back(std::move(task_closure.future));
+  }
+
+  EXPECT_LE(bounded_pool.size(), 2);
+
+  for (auto& future : futures) {
+    future.get();
+  }
+}
+
+TEST_F(blocking_pool_test, BlockingPoolShrinksAfterKeepAlive) {
+  rio::blocking_pool short_lived_pool(4, std::chrono::milliseconds(10));
+  auto task_closure = rio::task::make([]() { return 42; });
+
+  short_lived_pool.submit(std::move(task_closure.task));
+  EXPECT_EQ(task_closure.future.get(), 42);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_EQ(short_lived_pool.size(), 0);
+
+  // Ensure the pool can grow again after shrinking
+  auto next_closure = rio::task::make([]() { return 24; });
+  short_lived_pool.submit(std::move(next_closure.task));
+  EXPECT_EQ(next_closure.future.get(), 24);
+}
+
+TEST_F(blocking_pool_test, BlockingPoolExecutesPendingTasksWhenDestructed) {
+  std::future<int> future;
+
+  {
+    rio::blocking_pool temporary_pool(1);
+    auto task_closure = rio::task::make([]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      return 42;
+    });
+
+    future = std::move(task_closure.future);
+    temporary_pool.submit(std::move(task_closure.task));
+  }  // temporary_pool is destructed here
+
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F(blocking_pool_test, BlockingPoolWaitIdleWaitsForRunningTasks) {
+  std::atomic<bool> finished = false;
+  auto task_closure = rio::task::make([&finished]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    finished = true;
+  });
+
+  pool.submit(std::move(task_closure.task));
+  pool.wait_idle();
+  EXPECT_TRUE(finished.load());
+}
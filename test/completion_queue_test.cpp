@@ -0,0 +1,143 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/completion_queue.hpp"
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "rio/executor.hpp"
+#include "rio/scheduler.hpp"
+
+TEST(completion_queue_test, CompletionQueueDeliversResultsInOrder) {
+  rio::completion_queue<int> queue(8);
+  queue.complete(1, []() { return 42; });
+  queue.complete(2, []() { return 24; });
+
+  std::vector<std::pair<std::uint64_t, int>> results;
+  auto count = queue.drain([&](rio::completion<int>&& completion) {
+    results.emplace_back(completion.tag, completion.get());
+  });
+
+  EXPECT_EQ(count, 2);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0], std::make_pair(std::uint64_t(1), 42));
+  EXPECT_EQ(results[1], std::make_pair(std::uint64_t(2), 24));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(completion_queue_test, CompletionQueueCapturesExceptions) {
+  rio::completion_queue<int> queue(8);
+  queue.complete(7, []() -> int { throw std::runtime_error("error"); });
+
+  queue.drain([](rio::completion<int>&& completion) {
+    EXPECT_EQ(completion.tag, 7);
+    EXPECT_FALSE(completion.has_value());
+    EXPECT_THROW(completion.get(), std::runtime_error);
+  });
+}
+
+TEST(completion_queue_test, CompletionQueueHandlesVoidResults) {
+  rio::completion_queue<void> queue(8);
+  queue.complete(3, []() {});
+
+  auto count = queue.drain([](rio::completion<void>&& completion) {
+    EXPECT_EQ(completion.tag, 3);
+    EXPECT_TRUE(completion.has_value());
+    completion.get();
+  });
+
+  EXPECT_EQ(count, 1);
+}
+
+TEST(completion_queue_test, CompletionQueueDrainsInBatches) {
+  rio::completion_queue<int> queue(8);
+
+  for (int i = 0; i < 5; ++i) {
+    queue.complete(i, [i]() { return i; });
+  }
+
+  auto noop = [](rio::completion<int>&&) {};
+  EXPECT_EQ(queue.drain(noop, 2), 2);
+  EXPECT_EQ(queue.drain(noop, 2), 2);
+  EXPECT_EQ(queue.drain(noop, 2), 1);
+  EXPECT_EQ(queue.drain(noop, 2), 0);
+}
+
+TEST(completion_queue_test, CompletionQueueRoundsCapacityToPowerOfTwo) {
+  rio::completion_queue<int> queue(5);
+  EXPECT_EQ(queue.capacity(), 8);
+}
+
+TEST(completion_queue_test, CompletionQueueWithoutNotificationHasNoHandle) {
+  rio::completion_queue<int> queue(8);
+  EXPECT_EQ(queue.native_handle(), -1);
+}
+
+#if defined(__linux__)
+TEST(completion_queue_test, CompletionQueueSignalsEventfd) {
+  rio::completion_queue<int> queue(8, true);
+  ASSERT_GE(queue.native_handle(), 0);
+
+  pollfd fd = {queue.native_handle(), POLLIN, 0};
+  EXPECT_EQ(poll(&fd, 1, 0), 0);
+
+  queue.complete(1, []() { return 42; });
+  queue.complete(2, []() { return 24; });
+  EXPECT_EQ(poll(&fd, 1, 0), 1);
+
+  // The eventfd stays readable while completions remain after a partial drain
+  auto noop = [](rio::completion<int>&&) {};
+  EXPECT_EQ(queue.drain(noop, 1), 1);
+  EXPECT_EQ(poll(&fd, 1, 0), 1);
+
+  EXPECT_EQ(queue.drain(noop), 1);
+  EXPECT_EQ(poll(&fd, 1, 0), 0);
+}
+#endif
+
+TEST(completion_queue_test, ExecutorDeliversTaskResultsToCompletionQueue) {
+  constexpr int num_tasks = 1000;
+  rio::completion_queue<int> queue(64);
+  std::set<std::uint64_t> tags;
+  long long sum = 0;
+
+  {
+    rio::executor<4, rio::fcfs_scheduler> executor;
+    auto& scheduler = executor.get_scheduler();
+
+    // Submit from a separate thread, since a full ring blocks producers until
+    // the consumer drains it
+    std::thread producer([&]() {
+      for (int i = 0; i < num_tasks; ++i) {
+        scheduler.await_into(queue, i, [](int n) { return 2 * n; }, i);
+      }
+    });
+
+    while (tags.size() < num_tasks) {
+      queue.drain([&](rio::completion<int>&& completion) {
+        tags.insert(completion.tag);
+        sum += completion.get();
+      });
+    }
+
+    producer.join();
+  }
+
+  EXPECT_EQ(tags.size(), num_tasks);
+  EXPECT_EQ(sum, static_cast<long long>(num_tasks) * (num_tasks - 1));
+}
@@ -16,7 +16,10 @@
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <memory>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 #include "rio/scheduler.hpp"
 
 class executor_test : public ::testing::Test {
@@ -82,3 +85,209 @@ TEST_F(executor_test, ExecutorHandlesBlockingTasks) {
 
   EXPECT_EQ(future.get(), 42);
 }
+
+TEST_F(executor_test, ExecutorOffloadsBlockingTasks) {
+  // Occupy more threads than there are compute workers with blocking tasks,
+  // then ensure a compute task still runs while they are blocked
+  std::promise<void> gate;
+  std::shared_future<void> opened = gate.get_future().share();
+  std::vector<std::future<void>> blocked;
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    blocked.push_back(executor.get_scheduler().spawn_blocking(
+        [opened]() { opened.wait(); }));
+  }
+
+  auto future = executor.get_scheduler().await([]() { return 42; });
+  EXPECT_EQ(future.get(), 42);
+
+  gate.set_value();
+
+  for (auto& future : blocked) {
+    future.get();
+  }
+}
+
+TEST_F(executor_test, ExecutorPropagatesBlockingTaskExceptions) {
+  auto future = executor.get_scheduler().spawn_blocking(
+      []() { throw std::runtime_error("error"); });
+
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(executor_spin_test, SpinningExecutorExecutesTasks) {
+  rio::executor<2, rio::fcfs_scheduler, rio::wait_policy::spin> executor;
+
+  auto future1 = executor.get_scheduler().await([]() { return 42; });
+  auto future2 = executor.get_scheduler().await([]() { return 24; });
+
+  EXPECT_EQ(future1.get(), 42);
+  EXPECT_EQ(future2.get(), 24);
+}
+
+TEST(executor_spin_test, PinnedSpinningExecutorExecutesTasks) {
+  rio::executor<2, rio::fcfs_scheduler, rio::wait_policy::pinned_spin>
+      executor;
+
+  auto future = executor.get_scheduler().await([]() { return 42; });
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F(executor_test, ExecutorSpawnsFireAndForgetTasks) {
+  std::promise<int> result;
+  executor.get_scheduler().spawn([&result](int n) { result.set_value(2 * n); },
+                                 21);
+
+  EXPECT_EQ(result.get_future().get(), 42);
+}
+
+TEST(executor_exception_test, ExecutorPassesSpawnedTaskExceptionsToHandler) {
+  std::promise<std::exception_ptr> caught;
+  rio::executor<4, rio::fcfs_scheduler> executor(
+      [&caught](std::exception_ptr e) { caught.set_value(e); });
+
+  executor.get_scheduler().spawn([]() { throw std::runtime_error("error"); });
+
+  auto exception = caught.get_future().get();
+  EXPECT_THROW(std::rethrow_exception(exception), std::runtime_error);
+}
+
+TEST(executor_exception_test, ExecutorDiscardsExceptionsWithoutHandler) {
+  rio::executor<4, rio::fcfs_scheduler> executor;
+  executor.get_scheduler().spawn([]() { throw std::runtime_error("error"); });
+
+  auto future = executor.get_scheduler().await([]() { return 42; });
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST(executor_watchdog_test, ExecutorMigratesTasksOffStalledWorker) {
+  using namespace std::chrono_literals;
+
+  rio::executor<3, rio::fcfs_scheduler> executor;
+  auto& scheduler = executor.get_scheduler();
+  std::promise<void> stalled;
+  executor.watch(20ms, [&stalled](rio::worker_id wid, auto) {
+    EXPECT_EQ(wid, 0);
+    stalled.set_value();
+  });
+
+  // The first task is assigned to worker 0 and blocks until the gate opens,
+  // and round-robin assignment queues every other subsequent task behind it
+  std::promise<void> gate;
+  auto stuck = scheduler.await([&gate]() { gate.get_future().wait(); });
+
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 4; ++i) {
+    futures.push_back(scheduler.await([i]() { return i; }));
+  }
+
+  stalled.get_future().wait();
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(futures[i].wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(futures[i].get(), i);
+  }
+
+  EXPECT_EQ(executor.stall_count(), 1);
+
+  gate.set_value();
+  stuck.get();
+}
+
+TEST(executor_shutdown_test, ExecutorDrainsBlockingTasksBeforeStopping) {
+  std::atomic<int> result = 0;
+
+  {
+    rio::executor<4, rio::fcfs_scheduler> executor;
+    auto& scheduler = executor.get_scheduler();
+
+    // The blocking task is still running when the executor is destructed, and
+    // waits on a compute task which requires the master thread
+    auto started = std::make_shared<std::promise<void>>();
+    auto future = started->get_future();
+    scheduler.spawn_blocking([&scheduler, &result, started]() {
+      started->set_value();
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      result = scheduler.await([]() { return 42; }).get();
+    });
+
+    future.wait();
+  }  // executor is destructed here
+
+  EXPECT_EQ(result.load(), 42);
+}
+
+TEST(executor_watchdog_test, ExecutorKeepsTasksWhenSingleWorkerIsStalled) {
+  using namespace std::chrono_literals;
+
+  rio::executor<2, rio::fcfs_scheduler> executor;
+  auto& scheduler = executor.get_scheduler();
+  std::promise<void> stalled;
+  executor.watch(20ms, [&stalled](rio::worker_id, auto) {
+    stalled.set_value();
+  });
+
+  std::promise<void> gate;
+  auto stuck = scheduler.await([&gate]() { gate.get_future().wait(); });
+  auto queued = scheduler.await([]() { return 42; });
+
+  // With no healthy worker to migrate to, the queued task stays behind the
+  // stalled task until it finishes
+  stalled.get_future().wait();
+  EXPECT_EQ(queued.wait_for(50ms), std::future_status::timeout);
+
+  gate.set_value();
+  stuck.get();
+  EXPECT_EQ(queued.get(), 42);
+}
+
+TEST(executor_watchdog_test, ExecutorKeepsTasksWhenAllWorkersAreStalled) {
+  using namespace std::chrono_literals;
+
+  rio::executor<3, rio::fcfs_scheduler> executor;
+  auto& scheduler = executor.get_scheduler();
+  std::atomic<int> stalls = 0;
+  executor.watch(20ms, [&stalls](rio::worker_id, auto) { ++stalls; });
+
+  std::promise<void> gate;
+  std::shared_future<void> opened = gate.get_future().share();
+  auto stuck1 = scheduler.await([opened]() { opened.wait(); });
+  auto stuck2 = scheduler.await([opened]() { opened.wait(); });
+
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 4; ++i) {
+    futures.push_back(scheduler.await([i]() { return i; }));
+  }
+
+  while (stalls.load() < 2) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(futures[0].wait_for(50ms), std::future_status::timeout);
+
+  gate.set_value();
+  stuck1.get();
+  stuck2.get();
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(futures[i].get(), i);
+  }
+}
+
+TEST(executor_shutdown_test, ExecutorHandsOffQueuedBlockingTasks) {
+  std::future<int> future;
+
+  {
+    rio::executor<4, rio::fcfs_scheduler> executor;
+    auto& scheduler = executor.get_scheduler();
+
+    // The blocking task may still be in the scheduler's queue when the
+    // executor is destructed, and waits on a compute task
+    future = scheduler.spawn_blocking([&scheduler]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      return scheduler.await([]() { return 42; }).get();
+    });
+  }  // executor is destructed here
+
+  EXPECT_EQ(future.get(), 42);
+}
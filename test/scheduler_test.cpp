@@ -84,3 +84,13 @@ TEST_F(fcfs_scheduler_test, awaitSchedulesTaskAndReturnsFuture) {
   scheduled_task.task();
   EXPECT_EQ(future.get(), 42);
 }
+
+TEST(fcfs_scheduler_spin_test, SpinningSchedulerRetrievesTask) {
+  rio::fcfs_scheduler scheduler(4, rio::wait_policy::spin);
+  auto future = scheduler.await([]() { return 42; });
+
+  auto scheduled_task = scheduler.next();
+  EXPECT_EQ(scheduled_task.wid, 0);
+  scheduled_task.task();
+  EXPECT_EQ(future.get(), 42);
+}
@@ -0,0 +1,117 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/task_group.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include "rio/executor.hpp"
+#include "rio/scheduler.hpp"
+
+class task_group_test : public ::testing::Test {
+ protected:
+  rio::executor<4, rio::fcfs_scheduler> executor;
+};
+
+TEST_F(task_group_test, TaskGroupWaitsForAllSubtasks) {
+  std::atomic<int> count = 0;
+  rio::task_group group(executor.get_scheduler());
+
+  for (int i = 0; i < 10000; ++i) {
+    group.run([&count]() { ++count; });
+  }
+
+  group.wait();
+  EXPECT_EQ(count.load(), 10000);
+}
+
+TEST_F(task_group_test, TaskGroupForwardsArguments) {
+  std::atomic<int> sum = 0;
+  rio::task_group group(executor.get_scheduler());
+
+  for (int i = 1; i <= 100; ++i) {
+    group.run([&sum](int n) { sum += n; }, i);
+  }
+
+  group.wait();
+  EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST_F(task_group_test, TaskGroupWaitReturnsImmediatelyWhenEmpty) {
+  rio::task_group group(executor.get_scheduler());
+  group.wait();
+}
+
+TEST_F(task_group_test, TaskGroupRethrowsFirstException) {
+  std::atomic<int> count = 0;
+  rio::task_group group(executor.get_scheduler());
+
+  for (int i = 0; i < 100; ++i) {
+    group.run([&count]() {
+      ++count;
+      throw std::runtime_error("error");
+    });
+  }
+
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(count.load(), 100);
+}
+
+TEST_F(task_group_test, TaskGroupIsReusableAfterWait) {
+  std::atomic<int> count = 0;
+  rio::task_group group(executor.get_scheduler());
+
+  group.run([]() { throw std::runtime_error("error"); });
+  EXPECT_THROW(group.wait(), std::runtime_error);
+
+  group.run([&count]() { ++count; });
+  group.wait();
+  EXPECT_EQ(count.load(), 1);
+}
+
+TEST_F(task_group_test, TaskGroupSupportsNestedGroupsInsidePool) {
+  // Each subtask fans out and waits on its own group from a worker thread,
+  // which deadlocks unless waiting workers run queued tasks
+  std::atomic<int> count = 0;
+  auto& scheduler = executor.get_scheduler();
+  rio::task_group group(scheduler);
+
+  for (int i = 0; i < 16; ++i) {
+    group.run([&scheduler, &count]() {
+      rio::task_group nested(scheduler);
+
+      for (int j = 0; j < 16; ++j) {
+        nested.run([&count]() { ++count; });
+      }
+
+      nested.wait();
+    });
+  }
+
+  group.wait();
+  EXPECT_EQ(count.load(), 256);
+}
+
+TEST_F(task_group_test, TaskGroupWaitsWhenDestructed) {
+  std::atomic<int> count = 0;
+
+  {
+    rio::task_group group(executor.get_scheduler());
+
+    for (int i = 0; i < 100; ++i) {
+      group.run([&count]() { ++count; });
+    }
+  }  // group is destructed here
+
+  EXPECT_EQ(count.load(), 100);
+}
@@ -14,6 +14,7 @@
 #include "rio/task.hpp"
 #include <gtest/gtest.h>
 #include <future>
+#include <stdexcept>
 
 TEST(task_test, TaskExecutesFunctionCorrectly) {
   auto task_closure = rio::task::make([]() { return 42; });
@@ -80,3 +81,31 @@ TEST(task_test, TaskMoveAssignmentTransfersHasExecutedFlag) {
   EXPECT_FALSE(task_closure2.task.is_executable());
   EXPECT_EQ(task_closure1.future.get(), 42);
 }
+
+TEST(task_test, TaskMoveTransfersBlockingFlag) {
+  auto task_closure = rio::task::make([]() { return 42; });
+  EXPECT_FALSE(task_closure.task.is_blocking());
+
+  task_closure.task.mark_blocking();
+  rio::task moved_task = std::move(task_closure.task);
+
+  EXPECT_TRUE(moved_task.is_blocking());
+  moved_task();
+  EXPECT_EQ(task_closure.future.get(), 42);
+}
+
+TEST(task_test, DetachedTaskExecutesFunctionCorrectly) {
+  int result = 0;
+  auto task = rio::task::make_detached([&](int n) { result = 2 * n; }, 21);
+
+  task();
+  EXPECT_EQ(result, 42);
+  EXPECT_FALSE(task.is_executable());
+}
+
+TEST(task_test, DetachedTaskPropagatesException) {
+  auto task =
+      rio::task::make_detached([]() { throw std::runtime_error("error"); });
+
+  EXPECT_THROW(task(), std::runtime_error);
+}
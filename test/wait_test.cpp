@@ -0,0 +1,71 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/wait.hpp"
+#include <gtest/gtest.h>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include "rio/executor.hpp"
+#include "rio/scheduler.hpp"
+
+/// Computes the n-th Fibonacci number by recursively submitting tasks and
+/// waiting on them from within the pool.
+static auto fibonacci(rio::scheduler& scheduler, int n) -> int {
+  if (n < 2) {
+    return n;
+  }
+
+  auto left = scheduler.await(fibonacci, std::ref(scheduler), n - 1);
+  auto right = scheduler.await(fibonacci, std::ref(scheduler), n - 2);
+
+  return rio::get(left) + rio::get(right);
+}
+
+class wait_test : public ::testing::Test {
+ protected:
+  rio::executor<4, rio::fcfs_scheduler> executor;
+};
+
+TEST_F(wait_test, WaitReturnsResultOutsideOfPool) {
+  auto future = executor.get_scheduler().await([]() { return 42; });
+  EXPECT_EQ(rio::get(future), 42);
+}
+
+TEST_F(wait_test, WaitRethrowsException) {
+  auto future = executor.get_scheduler().await(
+      []() { throw std::runtime_error("error"); });
+
+  EXPECT_THROW(rio::get(future), std::runtime_error);
+}
+
+TEST_F(wait_test, WaitSupportsSharedFutures) {
+  auto future = executor.get_scheduler().await([]() { return 42; }).share();
+
+  rio::wait(future);
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F(wait_test, WaitHelpsWithNestedTasksInsidePool) {
+  // The recursion fans out to far more waiting tasks than there are workers,
+  // which deadlocks unless waiting workers run queued tasks
+  auto& scheduler = executor.get_scheduler();
+  auto future = scheduler.await(fibonacci, std::ref(scheduler), 15);
+
+  EXPECT_EQ(future.get(), 610);
+}
+
+TEST(worker_help_test, WorkerHelpIsNoOpOutsideOfPool) {
+  EXPECT_FALSE(rio::worker::is_worker_thread());
+  EXPECT_FALSE(rio::worker::help());
+}
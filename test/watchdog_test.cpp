@@ -0,0 +1,128 @@
+// MIT License
+// Copyright (c) 2024 Ayush Gundawar <ayushgundawar (at) gmail (dot) com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+#include "rio/watchdog.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <future>
+#include <thread>
+#include "rio/task.hpp"
+#include "rio/wait.hpp"
+#include "rio/worker.hpp"
+
+using namespace std::chrono_literals;
+
+class watchdog_test : public ::testing::Test {
+ protected:
+  std::array<rio::worker, 2> workers;
+};
+
+TEST_F(watchdog_test, WatchdogReportsStalledWorker) {
+  std::promise<rio::worker_id> stalled;
+  rio::watchdog watchdog(workers, 20ms,
+                         [&stalled](rio::worker_id wid, auto elapsed) {
+                           EXPECT_GE(elapsed, 20ms);
+                           stalled.set_value(wid);
+                         });
+
+  auto task_closure =
+      rio::task::make([]() { std::this_thread::sleep_for(200ms); });
+  workers[1].assign(std::move(task_closure.task));
+
+  EXPECT_EQ(stalled.get_future().get(), 1);
+  EXPECT_TRUE(workers[1].is_stalled());
+  EXPECT_FALSE(workers[0].is_stalled());
+
+  // The stall is reported once per task and cleared once the task finishes.
+  // The future is fulfilled just before the task returns, so allow the worker
+  // a moment to clear the flag.
+  task_closure.future.get();
+  for (int i = 0; i < 100 && workers[1].is_stalled(); ++i) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(watchdog.stall_count(), 1);
+  EXPECT_FALSE(workers[1].is_stalled());
+}
+
+TEST_F(watchdog_test, WatchdogIgnoresShortTasks) {
+  rio::watchdog watchdog(workers, 100ms);
+
+  for (auto& worker : workers) {
+    auto task_closure = rio::task::make([]() { return 42; });
+    worker.assign(std::move(task_closure.task));
+    EXPECT_EQ(task_closure.future.get(), 42);
+  }
+
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(watchdog.stall_count(), 0);
+}
+
+TEST_F(watchdog_test, WorkerReportsRunningTime) {
+  rio::watchdog watchdog(workers, 1s);
+  EXPECT_EQ(workers[0].running_for(), 0ns);
+
+  std::promise<void> started;
+  std::promise<void> gate;
+  auto task_closure = rio::task::make([&]() {
+    started.set_value();
+    gate.get_future().wait();
+  });
+
+  workers[0].assign(std::move(task_closure.task));
+  started.get_future().wait();
+  std::this_thread::sleep_for(10ms);
+  EXPECT_GE(workers[0].running_for(), 10ms);
+
+  gate.set_value();
+  task_closure.future.get();
+}
+
+TEST_F(watchdog_test, WorkerDoesNotTrackRunningTimeWithoutWatchdog) {
+  std::promise<void> started;
+  std::promise<void> gate;
+  auto task_closure = rio::task::make([&]() {
+    started.set_value();
+    gate.get_future().wait();
+  });
+
+  workers[0].assign(std::move(task_closure.task));
+  started.get_future().wait();
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(workers[0].running_for(), 0ns);
+
+  gate.set_value();
+  task_closure.future.get();
+}
+
+TEST_F(watchdog_test, WatchdogReportsStalledTaskOnceWhileHelping) {
+  // The stalled task waits on a shorter task queued behind it, which it runs
+  // itself while waiting, and then keeps running
+  rio::watchdog watchdog(workers, 40ms);
+  auto nested_closure =
+      rio::task::make([]() { std::this_thread::sleep_for(20ms); });
+  auto nested_future = std::move(nested_closure.future);
+
+  auto task_closure = rio::task::make([&nested_future]() {
+    std::this_thread::sleep_for(80ms);
+    rio::get(nested_future);
+    std::this_thread::sleep_for(80ms);
+  });
+
+  workers[0].assign(std::move(task_closure.task));
+  workers[0].assign(std::move(nested_closure.task));
+  task_closure.future.get();
+
+  EXPECT_EQ(watchdog.stall_count(), 1);
+}
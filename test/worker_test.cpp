@@ -14,7 +14,9 @@
 #include "rio/worker.hpp"
 #include <gtest/gtest.h>
 #include <atomic>
+#include <exception>
 #include <future>
+#include <stdexcept>
 #include "rio/task.hpp"
 
 class worker_test : public ::testing::Test {
@@ -69,3 +71,33 @@ TEST_F(worker_test, WorkerStopsWhenDestructed) {
 
   // No assertion here, just ensuring no crashes or hangs
 }
+
+TEST(worker_spin_test, SpinningWorkerExecutesTasks) {
+  rio::worker worker(rio::wait_policy::spin);
+  auto task_closure1 = rio::task::make([]() { return 42; });
+  auto task_closure2 = rio::task::make([]() { return 24; });
+
+  worker.assign(std::move(task_closure1.task));
+  worker.assign(std::move(task_closure2.task));
+
+  EXPECT_EQ(task_closure1.future.get(), 42);
+  EXPECT_EQ(task_closure2.future.get(), 24);
+}
+
+TEST(worker_exception_test, WorkerPassesDetachedTaskExceptionsToHandler) {
+  std::promise<std::exception_ptr> caught;
+  rio::worker worker(rio::wait_policy::park, [&caught](std::exception_ptr e) {
+    caught.set_value(e);
+  });
+
+  worker.assign(
+      rio::task::make_detached([]() { throw std::runtime_error("error"); }));
+
+  auto exception = caught.get_future().get();
+  EXPECT_THROW(std::rethrow_exception(exception), std::runtime_error);
+
+  // Ensure the worker keeps processing tasks after an exception
+  auto task_closure = rio::task::make([]() { return 42; });
+  worker.assign(std::move(task_closure.task));
+  EXPECT_EQ(task_closure.future.get(), 42);
+}